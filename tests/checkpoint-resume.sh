@@ -0,0 +1,48 @@
+#!/bin/sh
+# Check that a run which is killed and then continued with --resume writes
+# the same samples as a run with the same seed that was never interrupted.
+
+top_srcdir=`cd ${top_srcdir:-..} && pwd`
+top_builddir=`cd ${top_builddir:-..} && pwd`
+bali_phy=$top_builddir/src/bali-phy
+
+work=checkpoint-resume.dir
+rm -rf $work
+mkdir $work && cd $work || exit 1
+
+args="$top_srcdir/examples/EF-Tu/5d.fasta --data-dir $top_srcdir/Data --seed 7 --iterations 400 --traditional --checkpoint 10"
+
+$bali_phy $args --name whole > /dev/null 2>&1 || { echo "FAIL: the uninterrupted run failed"; exit 1; }
+
+# Kill the second run part of the way through, after it has saved a checkpoint.
+$bali_phy $args --name cut > /dev/null 2>&1 &
+pid=$!
+killed=no
+while kill -0 $pid 2>/dev/null; do
+    n=`cat cut-1/C1.p 2>/dev/null | wc -l`
+    if [ $n -ge 100 ]; then
+	kill $pid && killed=yes
+	break
+    fi
+    sleep 0.1
+done
+wait $pid
+status=$?
+
+# Otherwise --resume would only rerun the last few iterations of a finished run.
+if [ $killed != yes ] || [ $status -eq 0 ]; then
+    echo "FAIL: the run finished before it could be interrupted"
+    exit 1
+fi
+
+$bali_phy --resume cut-1 > /dev/null 2>&1 || { echo "FAIL: --resume failed"; exit 1; }
+
+for file in C1.p C1.trees C1.P1.fastas; do
+    if ! cmp -s whole-1/$file cut-1/$file; then
+	echo "FAIL: the resumed run wrote a different $file"
+	exit 1
+    fi
+done
+
+cd .. && rm -rf $work
+exit 0
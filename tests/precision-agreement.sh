@@ -0,0 +1,38 @@
+#!/bin/sh
+# Check that likelihoods computed in single precision agree with those
+# computed in double precision, using --precision=check.
+#
+# The run also samples pairwise alignments from single-precision DP matrices.
+# In a build configured with --enable-debug, this checks that each path is
+# sampled with the probability that the DP says it has.
+
+top_srcdir=`cd ${top_srcdir:-..} && pwd`
+top_builddir=`cd ${top_builddir:-..} && pwd`
+bali_phy=$top_builddir/src/bali-phy
+
+work=precision-agreement.dir
+rm -rf $work
+mkdir $work && cd $work || exit 1
+
+$bali_phy $top_srcdir/examples/EF-Tu/5d.fasta --data-dir $top_srcdir/Data \
+    --seed 7 --iterations 20 --precision=check --name check > /dev/null 2>&1 \
+    || { echo "FAIL: the run with --precision=check failed"; exit 1; }
+
+if ! grep -q "move walk_tree_sample_alignments: enabled" check-1/C1.out; then
+    echo "FAIL: the run did not sample alignments"
+    exit 1
+fi
+
+difference=`sed -n 's/^maximum log-likelihood difference from double precision = //p' check-1/C1.out`
+if [ -z "$difference" ]; then
+    echo "FAIL: no likelihoods were checked against double precision"
+    exit 1
+fi
+
+if ! awk "BEGIN {exit !($difference < 0.001)}"; then
+    echo "FAIL: float and double log-likelihoods differ by $difference"
+    exit 1
+fi
+
+cd .. && rm -rf $work
+exit 0